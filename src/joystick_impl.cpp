@@ -191,6 +191,41 @@ rrjoy::JoystickInfoPtr JoystickImpl::get_joystick_info() {
   return joy_info;
 }
 
+bool JoystickImpl::HasActiveClients() {
+  size_t count = 0;
+  if (rrvar_joystick_state) {
+    count += rrvar_joystick_state->GetActiveWireConnectionCount();
+  }
+  if (rrvar_gamepad_state) {
+    count += rrvar_gamepad_state->GetActiveWireConnectionCount();
+  }
+  if (rrvar_joystick_sensor_data) {
+    count += rrvar_joystick_sensor_data->GetActivePipeEndpointCount();
+  }
+  return count > 0;
+}
+
+bool JoystickImpl::IsIdleLocked() {
+  if (idle_update_rate <= 0.0) {
+    return false;
+  }
+  if (boost::posix_time::microsec_clock::universal_time() < idle_grace_end) {
+    return false;
+  }
+  return !HasActiveClients();
+}
+
+bool JoystickImpl::IsIdle() {
+  boost::mutex::scoped_lock lock(this_lock);
+  return idle;
+}
+
+void JoystickImpl::WakeFromIdle() {
+  boost::mutex::scoped_lock lock(this_lock);
+  idle_grace_end = boost::posix_time::microsec_clock::universal_time() +
+                   boost::posix_time::seconds(5);
+}
+
 void JoystickImpl::SendState() {
   boost::mutex::scoped_lock lock(this_lock);
 
@@ -202,6 +237,19 @@ void JoystickImpl::SendState() {
     return;
   }
 
+  idle = IsIdleLocked();
+  if (idle) {
+    // No wire or pipe subscribers. Keep the wire values current for
+    // PeekInValue() clients, but skip the downsampler and sensor data.
+    if (rrvar_joystick_state) {
+      rrvar_joystick_state->SetOutValue(fill_joystick_state(joy));
+    }
+    if (rrvar_gamepad_state) {
+      rrvar_gamepad_state->SetOutValue(fill_gamepad_state(pad));
+    }
+    return;
+  }
+
   RR::BroadcastDownsamplerStep step(downsampler);
 
   if (!rrvar_joystick_state) {
@@ -284,6 +332,16 @@ void JoystickImpl::set_update_downsample(uint32_t value) {
 
 double JoystickImpl::get_update_rate() { return 100.0; }
 
+double JoystickImpl::GetIdleUpdateRate() {
+  boost::mutex::scoped_lock lock(this_lock);
+  return idle_update_rate;
+}
+
+void JoystickImpl::SetIdleUpdateRate(double rate) {
+  boost::mutex::scoped_lock lock(this_lock);
+  idle_update_rate = rate;
+}
+
 JoystickImpl::~JoystickImpl() {
 
   if (has_ff) {
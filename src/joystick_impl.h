@@ -53,6 +53,13 @@ protected:
 
   rrjoy::JoystickInfoPtr joy_info;
 
+  double idle_update_rate = 10.0;
+  bool idle = false;
+  boost::posix_time::ptime idle_grace_end = boost::posix_time::min_date_time;
+
+  bool HasActiveClients();
+  bool IsIdleLocked();
+
 public:
   JoystickImpl();
 
@@ -65,6 +72,16 @@ public:
 
   void SendState();
 
+  // Idle decision made by the last call to SendState()
+  bool IsIdle();
+
+  // Run at full rate for a grace period so a newly connected client has time
+  // to connect the wires and pipe
+  void WakeFromIdle();
+
+  double GetIdleUpdateRate();
+  void SetIdleUpdateRate(double rate);
+
   virtual void rumble(double intensity, double duration);
 
   void force_feedback(const com::robotraconteur::geometry::Vector2 &force,
@@ -156,7 +156,21 @@ void identify_joystick() {
 } // namespace robotraconteur_joystick_driver
 
 bool keepgoing = true;
-void signal_handler() { keepgoing = false; }
+bool wake_from_idle = false;
+boost::mutex wait_lock;
+boost::condition_variable wait_cv;
+
+void signal_handler() {
+  boost::mutex::scoped_lock lock(wait_lock);
+  keepgoing = false;
+  wait_cv.notify_all();
+}
+
+void wake_idle_loop() {
+  boost::mutex::scoped_lock lock(wait_lock);
+  wake_from_idle = true;
+  wait_cv.notify_all();
+}
 
 int main(int argc, char *argv[]) {
 
@@ -186,7 +200,10 @@ int main(int argc, char *argv[]) {
         "identify", "identify joystick by holding a button")(
         "joystick-id", po::value<uint32_t>(),
         "joystick ID")("joystick-info-file", po::value<std::string>(),
-                       "joystick info file (required)");
+                       "joystick info file (required)")(
+        "idle-update-rate", po::value<double>(),
+        "update rate in Hz when no clients are subscribed, at least 1 and "
+        "less than 100, or 0 to disable idle mode");
 
     //
     // robotraconteur_joystick_driver::identify_joystick();
@@ -239,6 +256,18 @@ int main(int argc, char *argv[]) {
       return 1;
     }
 
+    double idle_update_rate = 10.0;
+    if (vm.count("idle-update-rate")) {
+      idle_update_rate = vm["idle-update-rate"].as<double>();
+      if (!(idle_update_rate == 0.0 ||
+            (idle_update_rate >= 1.0 && idle_update_rate < 100.0))) {
+        std::cerr << "idle-update-rate must be at least 1 and less than 100, "
+                     "or 0 to disable idle mode"
+                  << std::endl;
+        return 1;
+      }
+    }
+
     std::vector<RobotRaconteur::Companion::Util::LocalIdentifierLockPtr>
         identifier_locks;
 
@@ -251,6 +280,7 @@ int main(int argc, char *argv[]) {
 
     auto joy_impl = boost::make_shared<JoystickImpl>();
     joy_impl->Open(joy_id, joy_info);
+    joy_impl->SetIdleUpdateRate(idle_update_rate);
 
     std::string node_name = "com.robotraconteur.hid.joystick";
     node_name += boost::lexical_cast<std::string>(joy_id);
@@ -263,13 +293,49 @@ int main(int argc, char *argv[]) {
         "joystick", "com.robotraconteur.hid.joystick", joy_impl);
     service_context->SetAttributes(attributes);
 
+    // Leave idle as soon as a client connects, before it connects any wires
+    RR_WEAK_PTR<JoystickImpl> joy_impl_weak = joy_impl;
+    service_context->AddServerServiceListener(
+        [joy_impl_weak](const RR_SHARED_PTR<ServerContext> &,
+                        ServerServiceListenerEventType code,
+                        const RR_SHARED_PTR<void> &) {
+          if (code != ServerServiceListenerEventType_ClientConnected) {
+            return;
+          }
+          auto joy_impl1 = joy_impl_weak.lock();
+          if (!joy_impl1) {
+            return;
+          }
+          joy_impl1->WakeFromIdle();
+          wake_idle_loop();
+        });
+
     RR::RatePtr rate = RobotRaconteurNode::s()->CreateRate(100.0);
 
     std::cerr << "Robot Raconteur Joystick Driver Running Joystick ID: "
               << joy_id << ", press Ctrl-C to quit" << std::endl;
 
+    bool idle = false;
     while (keepgoing) {
       joy_impl->SendState();
+
+      if (joy_impl->IsIdle()) {
+        idle = true;
+        boost::posix_time::time_duration idle_period =
+            boost::posix_time::microseconds(
+                (int64_t)(1.0e6 / joy_impl->GetIdleUpdateRate()));
+        boost::mutex::scoped_lock lock(wait_lock);
+        wait_cv.timed_wait(lock, idle_period,
+                           []() { return !keepgoing || wake_from_idle; });
+        wake_from_idle = false;
+        continue;
+      }
+
+      if (idle) {
+        // Restart the rate so it does not try to catch up on idle ticks
+        idle = false;
+        rate = RobotRaconteurNode::s()->CreateRate(100.0);
+      }
       rate->Sleep();
     }
 